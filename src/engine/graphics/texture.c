@@ -30,6 +30,28 @@ int texture_load_png(Texture *tex, SDL_Renderer *renderer, const char *path) {
     return 0;
 }
 
+/*
+ * texture_create_target
+ *
+ * Create an SDL_TEXTUREACCESS_TARGET texture for off-screen rendering.
+ *
+ * Why: lets the world be drawn at a fixed resolution and scaled to the
+ * window in a single copy, so per-frame fill cost doesn't grow with the
+ * window.
+ */
+int texture_create_target(Texture *tex, SDL_Renderer *renderer, int width, int height) {
+    tex->sdl_texture = SDL_CreateTexture(renderer, SDL_PIXELFORMAT_RGBA8888,
+                                         SDL_TEXTUREACCESS_TARGET, width, height);
+    if (!tex->sdl_texture) {
+        fprintf(stderr, "SDL_CreateTexture Error: %s\n", SDL_GetError());
+        return -1;
+    }
+
+    tex->width = width;
+    tex->height = height;
+    return 0;
+}
+
 /*
  * texture_destroy
  *
@@ -26,6 +26,17 @@ typedef struct Texture {
  */
 int texture_load_png(Texture *tex, SDL_Renderer *renderer, const char *path);
 
+/*
+ * texture_create_target
+ *
+ * Purpose: create a blank texture of the given size that can be rendered
+ * into (see window_set_render_target()).
+ *
+ * Returns 0 on success, non-zero on failure. The caller must call
+ * texture_destroy() to clean up.
+ */
+int texture_create_target(Texture *tex, SDL_Renderer *renderer, int width, int height);
+
 /*
  * texture_destroy
  *
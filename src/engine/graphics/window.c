@@ -19,15 +19,18 @@ int window_init(Window *win, const char *title, int width, int height) {
                                        SDL_WINDOWPOS_CENTERED,
                                        SDL_WINDOWPOS_CENTERED,
                                        width, height,
-                                       SDL_WINDOW_SHOWN);
+                                       SDL_WINDOW_SHOWN | SDL_WINDOW_RESIZABLE);
     if (!win->sdl_window) {
         fprintf(stderr, "SDL_CreateWindow Error: %s\n", SDL_GetError());
         SDL_Quit();
         return -1;
     }
 
-    /* Create a hardware-accelerated renderer with vsync enabled. */
-    win->renderer = SDL_CreateRenderer(win->sdl_window, -1, SDL_RENDERER_ACCELERATED | SDL_RENDERER_PRESENTVSYNC);
+    /* Create a hardware-accelerated renderer with vsync enabled. Render
+     * target support is required for the fixed-resolution world target. */
+    win->renderer = SDL_CreateRenderer(win->sdl_window, -1,
+                                       SDL_RENDERER_ACCELERATED | SDL_RENDERER_PRESENTVSYNC |
+                                       SDL_RENDERER_TARGETTEXTURE);
     if (!win->renderer) {
         fprintf(stderr, "SDL_CreateRenderer Error: %s\n", SDL_GetError());
         SDL_DestroyWindow(win->sdl_window);
@@ -93,6 +96,60 @@ void window_draw_rect(Window *win, int x, int y, int w, int h, SDL_Color color)
 }
 
 
+/*
+ * Redirect draw calls to a target texture, or back to the window for NULL.
+ *
+ * Why: keeps SDL render-target handling in one place next to the other
+ * renderer wrappers.
+ */
+void window_set_render_target(Window *win, Texture *target) {
+    SDL_SetRenderTarget(win->renderer, target ? target->sdl_texture : NULL);
+}
+
+
+/*
+ * Copy a render target to the window, scaled uniformly and centred.
+ *
+ * Why: this is the only draw call whose fill cost depends on window size,
+ * and it happens once per frame regardless of how much was drawn into the
+ * target. The output size is queried from the renderer every call so
+ * resizes and high-DPI scaling are handled without tracking window events.
+ * The window is cleared to black first so the bars match the out-of-map
+ * colour inside the target, and the copy is clipped to the view so the
+ * extra margin texel never spills into the bars.
+ */
+void window_draw_render_target(Window *win, Texture *target, int view_width, int view_height,
+                               float offset_x, float offset_y) {
+    int out_w, out_h;
+    if (SDL_GetRendererOutputSize(win->renderer, &out_w, &out_h) != 0) {
+        out_w = win->width;
+        out_h = win->height;
+    }
+
+    float scale_x = (float)out_w / (float)view_width;
+    float scale_y = (float)out_h / (float)view_height;
+    float scale = scale_x < scale_y ? scale_x : scale_y;
+
+    SDL_Rect view;
+    view.w = (int)(view_width * scale);
+    view.h = (int)(view_height * scale);
+    view.x = (out_w - view.w) / 2;
+    view.y = (out_h - view.h) / 2;
+
+    SDL_FRect dest;
+    dest.x = view.x - offset_x * scale;
+    dest.y = view.y - offset_y * scale;
+    dest.w = target->width * scale;
+    dest.h = target->height * scale;
+
+    SDL_SetRenderDrawColor(win->renderer, 0, 0, 0, 255);
+    SDL_RenderClear(win->renderer);
+    SDL_RenderSetClipRect(win->renderer, &view);
+    SDL_RenderCopyF(win->renderer, target->sdl_texture, NULL, &dest);
+    SDL_RenderSetClipRect(win->renderer, NULL);
+}
+
+
 /*
  * Present the current backbuffer to the screen.
  *
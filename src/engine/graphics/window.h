@@ -2,6 +2,7 @@
 #define ENGINE_GRAPHICS_WINDOW_H
 
 #include <SDL2/SDL.h>
+#include "texture.h"
 
 /**
  * Window
@@ -60,6 +61,30 @@ void window_clear(Window *win);
 void window_draw_rect(Window *win, int x, int y, int w, int h, SDL_Color color);
 
 
+/*
+ * Select where subsequent draw calls go.
+ *
+ * Purpose: pass a texture created with texture_create_target() to render
+ * off-screen, or NULL to render to the window again.
+ */
+void window_set_render_target(Window *win, Texture *target);
+
+
+/*
+ * Scale a render target to fit the window.
+ *
+ * Purpose: copy an off-screen frame to the window once per frame. Only a
+ * view_width x view_height region is shown, scaled uniformly and centred
+ * with black bars. The target may be larger than the view; it is shifted
+ * left/up by (offset_x, offset_y) target pixels before clipping, which
+ * lets a camera position between target pixels show up at window
+ * resolution. Sizing uses the renderer's output size in real pixels, so
+ * it stays correct after resizes and under high-DPI scaling.
+ */
+void window_draw_render_target(Window *win, Texture *target, int view_width, int view_height,
+                               float offset_x, float offset_y);
+
+
 /*
  * Present the current frame.
  *
@@ -25,6 +25,14 @@ void input_handle_event(InputState *state, SDL_Event *ev) {
             case SDLK_RIGHT:
                 state->key_right = 1;
                 break;
+            case SDLK_EQUALS:
+            case SDLK_KP_PLUS:
+                if (!ev->key.repeat) state->zoom_steps++;
+                break;
+            case SDLK_MINUS:
+            case SDLK_KP_MINUS:
+                if (!ev->key.repeat) state->zoom_steps--;
+                break;
             default:
                 break;
         }
@@ -67,3 +75,15 @@ void input_get_movement(InputState *state, int *dx, int *dy) {
     if (state->key_left) *dx -= 5;
     if (state->key_right) *dx += 5;
 }
+
+/*
+ * input_take_zoom
+ *
+ * Zoom is an action rather than a held state, so presses accumulate until
+ * a system consumes them.
+ */
+int input_take_zoom(InputState *state) {
+    int steps = state->zoom_steps;
+    state->zoom_steps = 0;
+    return steps;
+}
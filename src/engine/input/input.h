@@ -15,6 +15,7 @@ typedef struct InputState {
     int key_down;
     int key_left;
     int key_right;
+    int zoom_steps; /* pending zoom presses: + for in, - for out */
 } InputState;
 
 /*
@@ -37,4 +38,14 @@ void input_handle_event(InputState *state, SDL_Event *ev);
  */
 void input_get_movement(InputState *state, int *dx, int *dy);
 
+/*
+ * input_take_zoom
+ *
+ * Purpose: return the zoom presses since the last call and clear them.
+ *
+ * Positive means zoom in (= or keypad +), negative means zoom out (- or
+ * keypad -). Presses are counted once; held-key repeats are ignored.
+ */
+int input_take_zoom(InputState *state);
+
 #endif /* ENGINE_INPUT_INPUT_H */
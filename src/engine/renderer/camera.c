@@ -0,0 +1,142 @@
+#include "camera.h"
+#include <math.h>
+
+#define CAMERA_MIN_ZOOM 0.25f
+#define CAMERA_MAX_ZOOM 8.0f
+
+/*
+ * camera_init
+ *
+ * Defaults: no zoom, a small dead zone so tiny movements don't shake the
+ * view, and smoothing that settles within a few frames at 60 FPS.
+ */
+void camera_init(Camera *cam, int view_width, int view_height) {
+    cam->x = 0.0f;
+    cam->y = 0.0f;
+    cam->zoom = 1.0f;
+    cam->smoothing = 0.15f;
+    cam->dead_zone_w = 16.0f;
+    cam->dead_zone_h = 16.0f;
+    cam->view_width = view_width;
+    cam->view_height = view_height;
+}
+
+float camera_visible_width(const Camera *cam) {
+    return (float)cam->view_width / cam->zoom;
+}
+
+float camera_visible_height(const Camera *cam) {
+    return (float)cam->view_height / cam->zoom;
+}
+
+/* Defined below; camera_set_zoom re-clamps after re-centring. */
+static float clamp_axis(float pos, float visible, int world);
+
+/*
+ * camera_set_zoom
+ *
+ * Recompute the top-left so the world point at the centre stays put, then
+ * clamp so the new visible size doesn't hang past the world edge.
+ */
+void camera_set_zoom(Camera *cam, float zoom, int world_width, int world_height) {
+    if (zoom < CAMERA_MIN_ZOOM) zoom = CAMERA_MIN_ZOOM;
+    if (zoom > CAMERA_MAX_ZOOM) zoom = CAMERA_MAX_ZOOM;
+
+    float center_x = cam->x + camera_visible_width(cam) * 0.5f;
+    float center_y = cam->y + camera_visible_height(cam) * 0.5f;
+    cam->zoom = zoom;
+    cam->x = clamp_axis(center_x - camera_visible_width(cam) * 0.5f,
+                        camera_visible_width(cam), world_width);
+    cam->y = clamp_axis(center_y - camera_visible_height(cam) * 0.5f,
+                        camera_visible_height(cam), world_height);
+}
+
+/*
+ * clamp_axis
+ *
+ * Keep one axis of the view inside the world. If the world is smaller than
+ * the view along this axis, centre it (the uncovered area is left to the
+ * clear colour) instead of scaling it up.
+ */
+static float clamp_axis(float pos, float visible, int world) {
+    if ((float)world <= visible) {
+        return ((float)world - visible) * 0.5f;
+    }
+    if (pos < 0.0f) return 0.0f;
+    if (pos > (float)world - visible) return (float)world - visible;
+    return pos;
+}
+
+/*
+ * camera_snap
+ *
+ * Jump straight to the clamped position centred on the target.
+ */
+void camera_snap(Camera *cam, float target_x, float target_y, int world_width, int world_height) {
+    float vw = camera_visible_width(cam);
+    float vh = camera_visible_height(cam);
+    cam->x = clamp_axis(target_x - vw * 0.5f, vw, world_width);
+    cam->y = clamp_axis(target_y - vh * 0.5f, vh, world_height);
+}
+
+/*
+ * follow_axis
+ *
+ * Dead zone + exponential smoothing for one axis. The goal is clamped
+ * before easing so the camera decelerates into world edges rather than
+ * overshooting and snapping back.
+ */
+static float follow_axis(float pos, float smoothing, float dead_zone,
+                         float target, float visible, int world) {
+    float center = pos + visible * 0.5f;
+    float offset = target - center;
+    float goal = pos;
+
+    if (offset > dead_zone) {
+        goal = pos + (offset - dead_zone);
+    } else if (offset < -dead_zone) {
+        goal = pos + (offset + dead_zone);
+    }
+    goal = clamp_axis(goal, visible, world);
+
+    float next = pos + (goal - pos) * smoothing;
+    /* Settle exactly once within a hundredth of a pixel to stop endless creep. */
+    if (fabsf(goal - next) < 0.01f) next = goal;
+    return next;
+}
+
+/*
+ * camera_follow
+ *
+ * Per-frame follow step. Call once per update with the target's centre.
+ */
+void camera_follow(Camera *cam, float target_x, float target_y, int world_width, int world_height) {
+    cam->x = follow_axis(cam->x, cam->smoothing, cam->dead_zone_w, target_x,
+                         camera_visible_width(cam), world_width);
+    cam->y = follow_axis(cam->y, cam->smoothing, cam->dead_zone_h, target_y,
+                         camera_visible_height(cam), world_height);
+}
+
+/*
+ * camera_world_to_screen
+ *
+ * Round the scaled world position and subtract the floored camera origin.
+ *
+ * Why: snapping the origin once (instead of the difference per draw) is
+ * what keeps every object on the same pixel grid; at integer zoom the
+ * result matches a nearest-sampled texture copy exactly. Flooring (not
+ * rounding) keeps the leftover fraction in [0, 1) so it is always a
+ * left/up shift at upscale time.
+ */
+void camera_world_to_screen(const Camera *cam, float world_x, float world_y,
+                            int *screen_x, int *screen_y) {
+    *screen_x = (int)roundf(world_x * cam->zoom) - (int)floorf(cam->x * cam->zoom);
+    *screen_y = (int)roundf(world_y * cam->zoom) - (int)floorf(cam->y * cam->zoom);
+}
+
+void camera_subpixel_offset(const Camera *cam, float *offset_x, float *offset_y) {
+    float ox = cam->x * cam->zoom;
+    float oy = cam->y * cam->zoom;
+    *offset_x = ox - floorf(ox);
+    *offset_y = oy - floorf(oy);
+}
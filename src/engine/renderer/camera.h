@@ -0,0 +1,93 @@
+#ifndef ENGINE_RENDERER_CAMERA_H
+#define ENGINE_RENDERER_CAMERA_H
+
+/*
+ * Camera
+ *
+ * 2D camera in world coordinates. Positions are floats so smoothing and
+ * zoom accumulate without rounding drift. For drawing into the render
+ * target, the position is floored to whole target pixels once per frame
+ * and every world draw is placed from that one origin, so sprites and the
+ * map move in lockstep. The fractional remainder (camera_subpixel_offset)
+ * is applied when the target is upscaled to the window, which is where
+ * the sub-pixel smoothing happens.
+ *
+ * The view is measured in render-target pixels, not window pixels, so the
+ * camera is unaffected by window size.
+ */
+typedef struct Camera {
+    float x;            /* top-left of the view in world coordinates */
+    float y;
+    float zoom;         /* render-target pixels per world pixel */
+    float smoothing;    /* fraction of the remaining distance covered per frame (1 = snap) */
+    float dead_zone_w;  /* half-size of the box around the view centre the target */
+    float dead_zone_h;  /* can move within without the camera following */
+    int view_width;     /* render-target size in pixels */
+    int view_height;
+} Camera;
+
+/*
+ * camera_init
+ *
+ * Purpose: set up a camera for a view of the given size (render-target
+ * pixels) with zoom 1 and default smoothing and dead zone.
+ */
+void camera_init(Camera *cam, int view_width, int view_height);
+
+/*
+ * camera_set_zoom
+ *
+ * Purpose: change zoom while keeping the view centred on the same world
+ * point, then clamp the view to the world (like camera_snap) so zooming
+ * out near an edge doesn't expose space outside the map. Zoom is clamped
+ * to a sane range.
+ */
+void camera_set_zoom(Camera *cam, float zoom, int world_width, int world_height);
+
+/*
+ * camera_visible_width / camera_visible_height
+ *
+ * Purpose: size of the visible region in world pixels at the current zoom.
+ */
+float camera_visible_width(const Camera *cam);
+float camera_visible_height(const Camera *cam);
+
+/*
+ * camera_snap
+ *
+ * Purpose: centre the view on a world point immediately (no smoothing),
+ * then clamp to the world. Use when entering a level.
+ */
+void camera_snap(Camera *cam, float target_x, float target_y, int world_width, int world_height);
+
+/*
+ * camera_follow
+ *
+ * Purpose: move the view towards a world point for this frame.
+ *
+ * The camera only moves once the target leaves the dead zone, then eases
+ * towards it by `smoothing`. The result is clamped to the world; worlds
+ * smaller than the view are centred rather than stretched.
+ */
+void camera_follow(Camera *cam, float target_x, float target_y, int world_width, int world_height);
+
+/*
+ * camera_world_to_screen
+ *
+ * Purpose: convert a world position to whole render-target pixels relative
+ * to the snapped camera origin. Use it for both corners of a rect (rather
+ * than scaling a width) so adjacent draws share edges exactly.
+ */
+void camera_world_to_screen(const Camera *cam, float world_x, float world_y,
+                            int *screen_x, int *screen_y);
+
+/*
+ * camera_subpixel_offset
+ *
+ * Purpose: the part of the camera position below one render-target pixel,
+ * in [0, 1) target pixels per axis. Shift the upscaled target left/up by
+ * this amount to show the true camera position.
+ */
+void camera_subpixel_offset(const Camera *cam, float *offset_x, float *offset_y);
+
+#endif /* ENGINE_RENDERER_CAMERA_H */
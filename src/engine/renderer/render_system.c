@@ -1,43 +1,118 @@
 #include "render_system.h"
+#include <math.h>
 #include <stdio.h>
+#include <string.h>
+
+/* Camera zoom range. Zoom is kept to whole steps so each world pixel maps
+ * to an exact block of target pixels and sprites stay aligned to the map. */
+#define RENDER_MIN_ZOOM 1
+#define RENDER_MAX_ZOOM 2
+
+/* Instructions all scripts may execute per frame before being deferred. */
+#define RENDER_SCRIPT_FRAME_BUDGET 10000
+
+/* Background image for each level id used by scripts. */
+static const char *level_paths[] = {
+    "src/game/assets/onetown.png",
+    "src/game/assets/overworld_level1.png",
+};
+
+/*
+ * script_load_level
+ *
+ * Script native: load_level(level, player_x, player_y). Switches to the
+ * given level and returns 0, or returns -1 if the level id is unknown or
+ * the background fails to load.
+ */
+static int script_load_level(void *user, const int *args, int argc) {
+    RenderSystemState *state = user;
+    if (argc != 3) {
+        fprintf(stderr, "load_level: expected 3 arguments, got %d\n", argc);
+        return -1;
+    }
+    int level = args[0];
+    if (level < 0 || level >= (int)(sizeof(level_paths) / sizeof(level_paths[0]))) {
+        fprintf(stderr, "load_level: unknown level %d\n", level);
+        return -1;
+    }
+    if (load_level(state, state->win, level_paths[level], args[1], args[2]) != 0) {
+        return -1;
+    }
+    state->current_level = level;
+    return 0;
+}
+
+/*
+ * render_scripts_init
+ *
+ * Bind script names directly to the fields of this state and compile the
+ * game logic scripts.
+ *
+ * Why: the state lives for the whole run, so scripts can read and write it
+ * through plain pointers instead of going through accessor calls.
+ */
+static int render_scripts_init(RenderSystemState *state) {
+    /* Level and world size are read-only: load_level is the only way to
+     * change them consistently with the loaded background. */
+    ScriptField fields[RENDER_SCRIPT_FIELD_COUNT] = {
+        { "player_x", &state->square_x, 0 },
+        { "player_y", &state->square_y, 0 },
+        { "current_level", &state->current_level, 1 },
+        { "world_width", &state->background.width, 1 },
+        { "world_height", &state->background.height, 1 },
+    };
+    ScriptNative natives[RENDER_SCRIPT_NATIVE_COUNT] = {
+        { "load_level", script_load_level },
+    };
+    memcpy(state->script_fields, fields, sizeof(fields));
+    memcpy(state->script_natives, natives, sizeof(natives));
+
+    ScriptBindings bindings = {
+        state->script_fields, RENDER_SCRIPT_FIELD_COUNT,
+        state->script_natives, RENDER_SCRIPT_NATIVE_COUNT,
+        state,
+    };
+    script_system_init(&state->scripts, &bindings, RENDER_SCRIPT_FRAME_BUDGET);
+    return script_system_load(&state->scripts, "level_transitions",
+                              "src/game/scripts/level_transitions.scr");
+}
 
 /*
  * render_system_init
  *
- * Initialize the render system state (position the square in the center and
- * load the background texture).
+ * Initialize the render system state (position the square in the center,
+ * load the background texture, create the world render target, and point
+ * the camera at the square).
  */
 int render_system_init(RenderSystemState *state, Window *win, int window_width, int window_height) {
     state->square_x = (window_width - 50) / 2;
     state->square_y = (window_height - 50) / 2;
-    state->camera_x = 0;
-    state->camera_y = 0;
     state->current_level = 0; /* Start at onetown */
+    state->win = win;
+    state->render_target.sdl_texture = NULL;
 
     if (texture_load_png(&state->background, win->renderer, "src/game/assets/onetown.png") != 0) {
         fprintf(stderr, "Failed to load background texture\n");
         return -1;
     }
-    /* Position camera to center on the square initially */
-    int cam_x = state->square_x + 25 - (window_width / 2);
-    int cam_y = state->square_y + 25 - (window_height / 2);
-    if (cam_x < 0) cam_x = 0;
-    if (cam_y < 0) cam_y = 0;
-    /* Clamp to background bounds if larger than the window */
-    if (state->background.width > window_width) {
-        int max_cx = state->background.width - window_width;
-        if (cam_x > max_cx) cam_x = max_cx;
-    } else {
-        cam_x = 0;
+    /* One texel of margin past the view for the sub-pixel shift at upscale */
+    if (texture_create_target(&state->render_target, win->renderer,
+                              RENDER_VIEW_WIDTH + 1, RENDER_VIEW_HEIGHT + 1) != 0) {
+        fprintf(stderr, "Failed to create render target\n");
+        texture_destroy(&state->background);
+        return -1;
     }
-    if (state->background.height > window_height) {
-        int max_cy = state->background.height - window_height;
-        if (cam_y > max_cy) cam_y = max_cy;
-    } else {
-        cam_y = 0;
+    if (render_scripts_init(state) != 0) {
+        script_system_destroy(&state->scripts);
+        texture_destroy(&state->render_target);
+        texture_destroy(&state->background);
+        return -1;
     }
-    state->camera_x = cam_x;
-    state->camera_y = cam_y;
+
+    /* Position camera to center on the square initially */
+    camera_init(&state->camera, RENDER_VIEW_WIDTH, RENDER_VIEW_HEIGHT);
+    camera_snap(&state->camera, state->square_x + 25.0f, state->square_y + 25.0f,
+                state->background.width, state->background.height);
     return 0;
 }
 
@@ -45,7 +120,8 @@ int render_system_init(RenderSystemState *state, Window *win, int window_width,
  * load_level
  *
  * Helper to load a new level background and reposition the player.
- * Unloads the old texture and loads the new one.
+ * Unloads the old texture and loads the new one. The camera snaps to the
+ * player rather than smoothly panning across the new map.
  */
 int load_level(RenderSystemState *state, Window *win, const char *bg_path, int player_x, int player_y) {
     texture_destroy(&state->background);
@@ -55,21 +131,59 @@ int load_level(RenderSystemState *state, Window *win, const char *bg_path, int p
     }
     state->square_x = player_x;
     state->square_y = player_y;
-    state->camera_x = 0;
-    state->camera_y = 0;
+    camera_snap(&state->camera, player_x + 25.0f, player_y + 25.0f,
+                state->background.width, state->background.height);
     return 0;
 }
 
+/*
+ * draw_background
+ *
+ * Copy the part of the background under the camera into the current render
+ * target.
+ *
+ * Why: the source rect is widened to whole texels covering the view and both
+ * destination corners go through camera_world_to_screen(), the same mapping
+ * the square uses, so the two never drift apart by a pixel. Areas outside a
+ * small map are simply not drawn (they keep the clear colour) instead of
+ * the map being stretched.
+ */
+static void draw_background(RenderSystemState *state, Window *win) {
+    const Camera *cam = &state->camera;
+    int x0 = (int)floorf(cam->x);
+    int y0 = (int)floorf(cam->y);
+    /* Cover the whole target, including its margin texel, not just the view */
+    int x1 = (int)ceilf(cam->x + state->render_target.width / cam->zoom);
+    int y1 = (int)ceilf(cam->y + state->render_target.height / cam->zoom);
+    if (x0 < 0) x0 = 0;
+    if (y0 < 0) y0 = 0;
+    if (x1 > state->background.width) x1 = state->background.width;
+    if (y1 > state->background.height) y1 = state->background.height;
+    if (x1 <= x0 || y1 <= y0) return;
+
+    SDL_Rect src = { x0, y0, x1 - x0, y1 - y0 };
+    SDL_Rect dest;
+    int right, bottom;
+    camera_world_to_screen(cam, (float)x0, (float)y0, &dest.x, &dest.y);
+    camera_world_to_screen(cam, (float)x1, (float)y1, &right, &bottom);
+    dest.w = right - dest.x;
+    dest.h = bottom - dest.y;
+    SDL_RenderCopy(win->renderer, state->background.sdl_texture, &src, &dest);
+}
+
 
 /*
  * render_system_update
  *
- * Update the square position based on input, check for level transitions,
- * draw the background texture, then draw the square on top.
+ * Update the square position based on input, run the game logic scripts
+ * (which handle level transitions), move the camera, draw the background
+ * texture and the square into the render target, then scale the target to
+ * the window.
  *
  * Why: demonstrates input integration with rendering and level transitions.
  * The system reads input state, updates entity positions, detects transitions,
- * and issues draw calls.
+ * and issues draw calls. World drawing happens at a fixed resolution so its
+ * cost doesn't depend on the window size.
  */
 void render_system_update(RenderSystemState *state, Window *win, InputState *input) {
     int dx, dy;
@@ -85,88 +199,64 @@ void render_system_update(RenderSystemState *state, Window *win, InputState *inp
     if (state->square_x + 50 > state->background.width) state->square_x = state->background.width - 50;
     if (state->square_y + 50 > state->background.height) state->square_y = state->background.height - 50;
 
-    /* Check for level transitions */
-    if (state->current_level == 0) {
-        /* On onetown: transition to overworld_level1 when hitting top or bottom edge */
-        if (state->square_y <= 0) {
-            /* Hit top edge of onetown, load overworld_level1 with player at specified position */
-            if (load_level(state, win, "src/game/assets/overworld_level1.png", 1800, 1180) == 0) {
-                state->current_level = 1;
-            }
-        } else if (state->square_y + 50 >= state->background.height) {
-            /* Hit bottom edge of onetown, load overworld_level1 with player at specified position */
-            if (load_level(state, win, "src/game/assets/overworld_level1.png", 1800, 1180) == 0) {
-                state->current_level = 1;
-            }
-        }
-    } else if (state->current_level == 1) {
-        /* On overworld_level1: transition back to onetown when at exit location */
-        if (state->square_x >= 1745 - 25 && state->square_x <= 1745 + 25 &&
-            state->square_y >= 1177 - 25 && state->square_y <= 1177 + 25) {
-            /* Player is near the exit point, load onetown */
-            if (load_level(state, win, "src/game/assets/onetown.png", 
-                          (500 - 50) / 2, (500 - 50) / 2) == 0) {
-                state->current_level = 0;
-            }
-        }
-    }
+    /* Run game logic scripts (level transitions) against the new position */
+    script_system_update(&state->scripts);
 
-    /* Compute camera so the square is near the center of the view */
-    int cam_x = state->square_x + 25 - (win->width / 2);
-    int cam_y = state->square_y + 25 - (win->height / 2);
-    if (cam_x < 0) cam_x = 0;
-    if (cam_y < 0) cam_y = 0;
-    if (state->background.width > win->width) {
-        int max_cx = state->background.width - win->width;
-        if (cam_x > max_cx) cam_x = max_cx;
-    } else {
-        cam_x = 0;
-    }
-    if (state->background.height > win->height) {
-        int max_cy = state->background.height - win->height;
-        if (cam_y > max_cy) cam_y = max_cy;
-    } else {
-        cam_y = 0;
-    }
-    state->camera_x = cam_x;
-    state->camera_y = cam_y;
-
-    /* Prepare source rect from the background texture. If the texture is
-     * smaller than the window, use the full texture as the source and
-     * stretch it to the window. Otherwise copy the window-sized region
-     * starting at the camera position. */
-    SDL_Rect src;
-    SDL_Rect dest = {0, 0, win->width, win->height};
-    if (state->background.width >= win->width) {
-        src.x = state->camera_x;
-        src.w = win->width;
-    } else {
-        src.x = 0;
-        src.w = state->background.width;
-    }
-    if (state->background.height >= win->height) {
-        src.y = state->camera_y;
-        src.h = win->height;
-    } else {
-        src.y = 0;
-        src.h = state->background.height;
+    /* Apply zoom key presses in whole steps */
+    int zoom_steps = input_take_zoom(input);
+    if (zoom_steps != 0) {
+        int zoom = (int)state->camera.zoom + zoom_steps;
+        if (zoom < RENDER_MIN_ZOOM) zoom = RENDER_MIN_ZOOM;
+        if (zoom > RENDER_MAX_ZOOM) zoom = RENDER_MAX_ZOOM;
+        camera_set_zoom(&state->camera, (float)zoom,
+                        state->background.width, state->background.height);
     }
 
-    /* Draw background region scaled to the window */
-    SDL_RenderCopy(win->renderer, state->background.sdl_texture, &src, &dest);
+    /* Ease the camera towards the square's center */
+    camera_follow(&state->camera, state->square_x + 25.0f, state->square_y + 25.0f,
+                  state->background.width, state->background.height);
+
+    /* Draw the world into the fixed-resolution target, black outside the map */
+    window_set_render_target(win, &state->render_target);
+    SDL_SetRenderDrawColor(win->renderer, 0, 0, 0, 255);
+    SDL_RenderClear(win->renderer);
+
+    draw_background(state, win);
 
-    /* Compute on-screen position for the square (world -> screen) */
-    int screen_x = state->square_x - state->camera_x;
-    int screen_y = state->square_y - state->camera_y;
+    /* Compute position for the square (world -> render target) */
+    int screen_x, screen_y, screen_right, screen_bottom;
+    camera_world_to_screen(&state->camera, (float)state->square_x, (float)state->square_y,
+                           &screen_x, &screen_y);
+    camera_world_to_screen(&state->camera, (float)(state->square_x + 50), (float)(state->square_y + 50),
+                           &screen_right, &screen_bottom);
     SDL_Color green = { 0, 255, 0, 255 };
-    window_draw_rect(win, screen_x, screen_y, 50, 50, green);
+    window_draw_rect(win, screen_x, screen_y, screen_right - screen_x, screen_bottom - screen_y, green);
+
+    /* Scale the finished world frame to the window in a single copy,
+     * shifted by the camera's sub-pixel remainder */
+    window_set_render_target(win, NULL);
+    float offset_x, offset_y;
+    camera_subpixel_offset(&state->camera, &offset_x, &offset_y);
+    window_draw_render_target(win, &state->render_target, RENDER_VIEW_WIDTH, RENDER_VIEW_HEIGHT,
+                              offset_x, offset_y);
+}
+
+/*
+ * render_system_print_profile
+ *
+ * Forward to the script system's cost table.
+ */
+void render_system_print_profile(const RenderSystemState *state, FILE *out) {
+    script_system_print_profile(&state->scripts, out);
 }
 
 /*
  * render_system_destroy
  *
- * Clean up the background texture.
+ * Clean up the background texture, render target and compiled scripts.
  */
 void render_system_destroy(RenderSystemState *state) {
+    script_system_destroy(&state->scripts);
+    texture_destroy(&state->render_target);
     texture_destroy(&state->background);
 }
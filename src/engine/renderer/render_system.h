@@ -4,6 +4,18 @@
 #include "../graphics/window.h"
 #include "../graphics/texture.h"
 #include "../input/input.h"
+#include "../scripting/script_system.h"
+#include "camera.h"
+
+/* Fixed low resolution the world is viewed at before scaling to the window.
+ * Half the default 500x500 window, so the default upscale is exactly 2x.
+ * The render target texture is one texel larger than this on each axis so
+ * the camera's sub-pixel remainder can be applied during the upscale. */
+#define RENDER_VIEW_WIDTH  250
+#define RENDER_VIEW_HEIGHT 250
+
+#define RENDER_SCRIPT_FIELD_COUNT  5
+#define RENDER_SCRIPT_NATIVE_COUNT 1
 
 /*
  * RenderSystemState
@@ -15,17 +27,26 @@ typedef struct RenderSystemState {
     int square_x;
     int square_y;
     Texture background;
-    /* Camera top-left in world/background coordinates */
-    int camera_x;
-    int camera_y;
+    /* Camera following the square, in world/background coordinates */
+    Camera camera;
+    /* Off-screen target the world is drawn into each frame */
+    Texture render_target;
     /* Current level (0 = onetown, 1 = overworld_level1) */
     int current_level;
+    /* Window cached for script natives that need the renderer */
+    Window *win;
+    /* Game logic scripts and the engine data they are bound to */
+    ScriptField script_fields[RENDER_SCRIPT_FIELD_COUNT];
+    ScriptNative script_natives[RENDER_SCRIPT_NATIVE_COUNT];
+    ScriptSystem scripts;
 } RenderSystemState;
 
 /*
  * render_system_init
  *
- * Purpose: initialize the render system state (square position and load background).
+ * Purpose: initialize the render system state (square position, load
+ * background, create the world render target, and compile the game logic
+ * scripts).
  */
 int render_system_init(RenderSystemState *state, Window *win, int window_width, int window_height);
 
@@ -34,15 +55,26 @@ int render_system_init(RenderSystemState *state, Window *win, int window_width,
  *
  * Purpose: update entity positions based on input and issue draw calls.
  *
- * This function updates the square position based on input, then draws the
- * background texture and the square on top.
+ * This function updates the square position based on input, runs the game
+ * logic scripts (level transitions), moves the camera, then draws the
+ * background texture and the square on top into the render target and
+ * scales that to the window.
  */
 void render_system_update(RenderSystemState *state, Window *win, InputState *input);
 
+/*
+ * render_system_print_profile
+ *
+ * Purpose: write per-script cost (instructions and time) for the session
+ * to `out`.
+ */
+void render_system_print_profile(const RenderSystemState *state, FILE *out);
+
 /*
  * render_system_destroy
  *
- * Purpose: clean up resources (background texture).
+ * Purpose: clean up resources (background texture, render target and
+ * scripts).
  */
 void render_system_destroy(RenderSystemState *state);
 
@@ -52,7 +84,8 @@ void render_system_destroy(RenderSystemState *state);
  * Purpose: internal helper to load a new background and reposition the player.
  *
  * Unloads the current background and loads a new one at the specified path,
- * then positions the player at the given coordinates.
+ * then positions the player at the given coordinates and snaps the camera
+ * to them.
  */
 int load_level(RenderSystemState *state, Window *win, const char *bg_path, int player_x, int player_y);
 
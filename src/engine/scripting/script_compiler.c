@@ -0,0 +1,397 @@
+#include "script_compiler.h"
+#include <ctype.h>
+#include <errno.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define SCRIPT_MAX_LABELS 256
+#define SCRIPT_MAX_NAME   32
+#define SCRIPT_MAX_TOKENS 5
+#define SCRIPT_MAX_LINE   256
+
+/* Operand layouts understood by the compiler. */
+typedef enum OperandFormat {
+    FMT_NONE,      /* halt                    */
+    FMT_R_R,       /* mov rA, rB              */
+    FMT_R_K,       /* loadk rA, 123           */
+    FMT_R_R_R,     /* add rA, rB, rC          */
+    FMT_R_R_R_SWAP,/* gt rA, rB, rC -> lt rA, rC, rB */
+    FMT_LABEL,     /* jmp label               */
+    FMT_R_LABEL,   /* jz rA, label            */
+    FMT_R_FIELD,   /* ldf rA, field           */
+    FMT_CALL       /* call native, rA, argc   */
+} OperandFormat;
+
+typedef struct Mnemonic {
+    const char *name;
+    ScriptOpcode op;
+    OperandFormat format;
+} Mnemonic;
+
+static const Mnemonic mnemonics[] = {
+    { "halt",  SCRIPT_OP_HALT,  FMT_NONE },
+    { "yield", SCRIPT_OP_YIELD, FMT_NONE },
+    { "mov",   SCRIPT_OP_MOV,   FMT_R_R },
+    { "not",   SCRIPT_OP_NOT,   FMT_R_R },
+    { "loadk", SCRIPT_OP_LOADK, FMT_R_K },
+    { "add",   SCRIPT_OP_ADD,   FMT_R_R_R },
+    { "sub",   SCRIPT_OP_SUB,   FMT_R_R_R },
+    { "mul",   SCRIPT_OP_MUL,   FMT_R_R_R },
+    { "div",   SCRIPT_OP_DIV,   FMT_R_R_R },
+    { "mod",   SCRIPT_OP_MOD,   FMT_R_R_R },
+    { "lt",    SCRIPT_OP_LT,    FMT_R_R_R },
+    { "le",    SCRIPT_OP_LE,    FMT_R_R_R },
+    { "eq",    SCRIPT_OP_EQ,    FMT_R_R_R },
+    { "gt",    SCRIPT_OP_LT,    FMT_R_R_R_SWAP },
+    { "ge",    SCRIPT_OP_LE,    FMT_R_R_R_SWAP },
+    { "jmp",   SCRIPT_OP_JMP,   FMT_LABEL },
+    { "jz",    SCRIPT_OP_JZ,    FMT_R_LABEL },
+    { "jnz",   SCRIPT_OP_JNZ,   FMT_R_LABEL },
+    { "ldf",   SCRIPT_OP_LDF,   FMT_R_FIELD },
+    { "stf",   SCRIPT_OP_STF,   FMT_R_FIELD },
+    { "call",  SCRIPT_OP_CALL,  FMT_CALL },
+};
+
+/* A label definition or a forward reference waiting to be patched. */
+typedef struct LabelEntry {
+    char name[SCRIPT_MAX_NAME];
+    int target; /* instruction index (definition) or instruction to patch (reference) */
+    int line;
+} LabelEntry;
+
+typedef struct Compiler {
+    const char *name;
+    const ScriptBindings *bindings;
+    int line;
+    uint32_t code[SCRIPT_MAX_CODE];
+    int code_length;
+    int constants[SCRIPT_MAX_CONSTANTS];
+    int constant_count;
+    LabelEntry labels[SCRIPT_MAX_LABELS];
+    int label_count;
+    LabelEntry fixups[SCRIPT_MAX_LABELS];
+    int fixup_count;
+} Compiler;
+
+static int compile_error(Compiler *c, const char *message, const char *token) {
+    fprintf(stderr, "Script compile error: %s:%d: %s%s%s\n", c->name, c->line,
+            message, token ? ": " : "", token ? token : "");
+    return -1;
+}
+
+static int parse_register(Compiler *c, const char *tok, int *out) {
+    char *end;
+    long v;
+    if (tok[0] != 'r') return compile_error(c, "expected register", tok);
+    errno = 0;
+    v = strtol(tok + 1, &end, 10);
+    if (errno != 0 || end == tok + 1 || *end != '\0' || v < 0 || v >= SCRIPT_NUM_REGISTERS) {
+        return compile_error(c, "bad register", tok);
+    }
+    *out = (int)v;
+    return 0;
+}
+
+static int parse_int(Compiler *c, const char *tok, long min, long max, long *out) {
+    char *end;
+    long v;
+    errno = 0;
+    v = strtol(tok, &end, 0);
+    if (errno != 0 || end == tok || *end != '\0' || v < min || v > max) {
+        return compile_error(c, "bad integer", tok);
+    }
+    *out = v;
+    return 0;
+}
+
+/* Intern a constant, reusing an existing pool slot when possible. */
+static int add_constant(Compiler *c, int value, int *index) {
+    for (int i = 0; i < c->constant_count; i++) {
+        if (c->constants[i] == value) {
+            *index = i;
+            return 0;
+        }
+    }
+    if (c->constant_count >= SCRIPT_MAX_CONSTANTS) {
+        return compile_error(c, "too many constants", NULL);
+    }
+    c->constants[c->constant_count] = value;
+    *index = c->constant_count++;
+    return 0;
+}
+
+static int find_field(Compiler *c, const char *tok, int *out) {
+    for (int i = 0; i < c->bindings->field_count; i++) {
+        if (strcmp(c->bindings->fields[i].name, tok) == 0) {
+            *out = i;
+            return 0;
+        }
+    }
+    return compile_error(c, "unknown field", tok);
+}
+
+static int find_native(Compiler *c, const char *tok, int *out) {
+    for (int i = 0; i < c->bindings->native_count && i <= 0xFF; i++) {
+        if (strcmp(c->bindings->natives[i].name, tok) == 0) {
+            *out = i;
+            return 0;
+        }
+    }
+    return compile_error(c, "unknown native", tok);
+}
+
+/* Record a jump whose target is patched once all labels are known. */
+static int add_fixup(Compiler *c, const char *label) {
+    if (c->fixup_count >= SCRIPT_MAX_LABELS) {
+        return compile_error(c, "too many jumps", NULL);
+    }
+    if (strlen(label) >= SCRIPT_MAX_NAME) {
+        return compile_error(c, "label name too long", label);
+    }
+    LabelEntry *f = &c->fixups[c->fixup_count++];
+    strcpy(f->name, label);
+    f->target = c->code_length;
+    f->line = c->line;
+    return 0;
+}
+
+static int define_label(Compiler *c, char *tok) {
+    size_t len = strlen(tok);
+    tok[len - 1] = '\0'; /* drop the ':' */
+    if (len < 2 || len - 1 >= SCRIPT_MAX_NAME) {
+        return compile_error(c, "bad label", tok);
+    }
+    for (int i = 0; i < c->label_count; i++) {
+        if (strcmp(c->labels[i].name, tok) == 0) {
+            return compile_error(c, "duplicate label", tok);
+        }
+    }
+    if (c->label_count >= SCRIPT_MAX_LABELS) {
+        return compile_error(c, "too many labels", NULL);
+    }
+    LabelEntry *l = &c->labels[c->label_count++];
+    strcpy(l->name, tok);
+    l->target = c->code_length;
+    l->line = c->line;
+    return 0;
+}
+
+static int emit(Compiler *c, uint32_t ins) {
+    if (c->code_length >= SCRIPT_MAX_CODE) {
+        return compile_error(c, "script too long", NULL);
+    }
+    c->code[c->code_length++] = ins;
+    return 0;
+}
+
+/* Compile one instruction given its already-split tokens. */
+static int compile_instruction(Compiler *c, char **tok, int ntok) {
+    const Mnemonic *m = NULL;
+    for (size_t i = 0; i < sizeof(mnemonics) / sizeof(mnemonics[0]); i++) {
+        if (strcmp(mnemonics[i].name, tok[0]) == 0) {
+            m = &mnemonics[i];
+            break;
+        }
+    }
+    if (!m) return compile_error(c, "unknown instruction", tok[0]);
+
+    static const int operand_counts[] = {
+        [FMT_NONE] = 0, [FMT_R_R] = 2, [FMT_R_K] = 2,
+        [FMT_R_R_R] = 3, [FMT_R_R_R_SWAP] = 3, [FMT_LABEL] = 1,
+        [FMT_R_LABEL] = 2, [FMT_R_FIELD] = 2, [FMT_CALL] = 3,
+    };
+    if (ntok - 1 != operand_counts[m->format]) {
+        return compile_error(c, "wrong number of operands for", tok[0]);
+    }
+
+    int a, b, idx;
+    long v;
+    switch (m->format) {
+        case FMT_NONE:
+            return emit(c, SCRIPT_ENCODE(m->op, 0, 0, 0));
+        case FMT_R_R:
+            if (parse_register(c, tok[1], &a) || parse_register(c, tok[2], &b)) return -1;
+            return emit(c, SCRIPT_ENCODE(m->op, a, b, 0));
+        case FMT_R_K:
+            if (parse_register(c, tok[1], &a)) return -1;
+            if (parse_int(c, tok[2], -2147483647L - 1, 2147483647L, &v)) return -1;
+            if (add_constant(c, (int)v, &idx)) return -1;
+            return emit(c, SCRIPT_ENCODE_BC(m->op, a, idx));
+        case FMT_R_R_R:
+        case FMT_R_R_R_SWAP: {
+            int rc;
+            if (parse_register(c, tok[1], &a) || parse_register(c, tok[2], &b) ||
+                parse_register(c, tok[3], &rc)) return -1;
+            if (m->format == FMT_R_R_R_SWAP) return emit(c, SCRIPT_ENCODE(m->op, a, rc, b));
+            return emit(c, SCRIPT_ENCODE(m->op, a, b, rc));
+        }
+        case FMT_LABEL:
+            if (add_fixup(c, tok[1])) return -1;
+            return emit(c, SCRIPT_ENCODE(m->op, 0, 0, 0));
+        case FMT_R_LABEL:
+            if (parse_register(c, tok[1], &a)) return -1;
+            if (add_fixup(c, tok[2])) return -1;
+            return emit(c, SCRIPT_ENCODE(m->op, a, 0, 0));
+        case FMT_R_FIELD:
+            if (parse_register(c, tok[1], &a) || find_field(c, tok[2], &idx)) return -1;
+            if (m->op == SCRIPT_OP_STF && c->bindings->fields[idx].read_only) {
+                return compile_error(c, "field is read-only", tok[2]);
+            }
+            return emit(c, SCRIPT_ENCODE_BC(m->op, a, idx));
+        case FMT_CALL:
+            if (find_native(c, tok[1], &idx) || parse_register(c, tok[2], &a)) return -1;
+            if (parse_int(c, tok[3], 1, SCRIPT_NUM_REGISTERS, &v)) return -1;
+            if (a + v > SCRIPT_NUM_REGISTERS) {
+                return compile_error(c, "call arguments run past the last register", tok[2]);
+            }
+            return emit(c, SCRIPT_ENCODE(m->op, a, (int)v, idx));
+    }
+    return compile_error(c, "unhandled instruction format", tok[0]);
+}
+
+/* Split a line into tokens in place and compile any label/instruction on it. */
+static int compile_line(Compiler *c, char *line) {
+    char *tok[SCRIPT_MAX_TOKENS];
+    int ntok = 0;
+
+    char *comment = strpbrk(line, "#;");
+    if (comment) *comment = '\0';
+
+    char *p = line;
+    while (*p) {
+        while (*p && (isspace((unsigned char)*p) || *p == ',')) *p++ = '\0';
+        if (!*p) break;
+        if (ntok >= SCRIPT_MAX_TOKENS) return compile_error(c, "too many operands", NULL);
+        tok[ntok++] = p;
+        while (*p && !isspace((unsigned char)*p) && *p != ',') p++;
+    }
+
+    int first = 0;
+    if (ntok > 0 && tok[0][strlen(tok[0]) - 1] == ':') {
+        if (define_label(c, tok[0])) return -1;
+        first = 1;
+    }
+    if (ntok - first == 0) return 0;
+    return compile_instruction(c, tok + first, ntok - first);
+}
+
+/* Patch every jump with the address of its label. */
+static int resolve_labels(Compiler *c) {
+    for (int i = 0; i < c->fixup_count; i++) {
+        LabelEntry *f = &c->fixups[i];
+        int found = -1;
+        for (int j = 0; j < c->label_count; j++) {
+            if (strcmp(c->labels[j].name, f->name) == 0) {
+                found = c->labels[j].target;
+                break;
+            }
+        }
+        if (found < 0) {
+            c->line = f->line;
+            return compile_error(c, "undefined label", f->name);
+        }
+        uint32_t ins = c->code[f->target];
+        c->code[f->target] = SCRIPT_ENCODE_BC(SCRIPT_OP(ins), SCRIPT_A(ins), found);
+    }
+    return 0;
+}
+
+/*
+ * script_compile
+ *
+ * Compile line by line into a scratch Compiler, resolve labels, then copy
+ * the exact-size code and constant pool into heap storage owned by `prog`.
+ *
+ * Why: all validation (register ranges, field/native names, jump targets)
+ * happens here, once, so the VM loop can trust its operands.
+ */
+int script_compile(ScriptProgram *prog, const char *source, const char *name,
+                   const ScriptBindings *bindings) {
+    Compiler *c = calloc(1, sizeof(Compiler));
+    if (!c) {
+        fprintf(stderr, "Script compile error: %s: out of memory\n", name);
+        return -1;
+    }
+    c->name = name;
+    c->bindings = bindings;
+
+    const char *p = source;
+    int result = 0;
+    while (*p && result == 0) {
+        char line[SCRIPT_MAX_LINE];
+        size_t len = strcspn(p, "\n");
+        c->line++;
+        if (len >= sizeof(line)) {
+            result = compile_error(c, "line too long", NULL);
+            break;
+        }
+        memcpy(line, p, len);
+        line[len] = '\0';
+        result = compile_line(c, line);
+        p += len;
+        if (*p == '\n') p++;
+    }
+
+    /* Implicit HALT so execution never runs past the end of the code. */
+    if (result == 0) result = emit(c, SCRIPT_ENCODE(SCRIPT_OP_HALT, 0, 0, 0));
+    if (result == 0) result = resolve_labels(c);
+
+    if (result == 0) {
+        prog->code = malloc(sizeof(uint32_t) * c->code_length);
+        prog->constants = malloc(sizeof(int) * (c->constant_count > 0 ? c->constant_count : 1));
+        if (!prog->code || !prog->constants) {
+            free(prog->code);
+            free(prog->constants);
+            prog->code = NULL;
+            prog->constants = NULL;
+            fprintf(stderr, "Script compile error: %s: out of memory\n", name);
+            result = -1;
+        } else {
+            memcpy(prog->code, c->code, sizeof(uint32_t) * c->code_length);
+            memcpy(prog->constants, c->constants, sizeof(int) * c->constant_count);
+            prog->code_length = c->code_length;
+            prog->constant_count = c->constant_count;
+        }
+    }
+
+    free(c);
+    return result;
+}
+
+/*
+ * script_compile_file
+ *
+ * Read the whole file into memory and hand it to script_compile().
+ */
+int script_compile_file(ScriptProgram *prog, const char *path,
+                        const ScriptBindings *bindings) {
+    FILE *f = fopen(path, "rb");
+    if (!f) {
+        fprintf(stderr, "Failed to open script: %s\n", path);
+        return -1;
+    }
+
+    fseek(f, 0, SEEK_END);
+    long size = ftell(f);
+    fseek(f, 0, SEEK_SET);
+    if (size < 0) {
+        fprintf(stderr, "Failed to read script: %s\n", path);
+        fclose(f);
+        return -1;
+    }
+
+    char *source = malloc((size_t)size + 1);
+    if (!source) {
+        fprintf(stderr, "Failed to read script: %s\n", path);
+        fclose(f);
+        return -1;
+    }
+    size_t n = fread(source, 1, (size_t)size, f);
+    source[n] = '\0';
+    fclose(f);
+
+    int result = script_compile(prog, source, path, bindings);
+    free(source);
+    return result;
+}
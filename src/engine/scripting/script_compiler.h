@@ -0,0 +1,48 @@
+#ifndef ENGINE_SCRIPTING_SCRIPT_COMPILER_H
+#define ENGINE_SCRIPTING_SCRIPT_COMPILER_H
+
+#include "script_vm.h"
+
+/*
+ * Script source format
+ *
+ * One instruction per line, operands separated by commas or spaces.
+ * `#` and `;` start a comment. A token ending in `:` defines a label.
+ *
+ *   halt                      yield
+ *   mov   rA, rB              not   rA, rB
+ *   loadk rA, <integer>
+ *   add|sub|mul|div|mod rA, rB, rC
+ *   lt|le|gt|ge|eq      rA, rB, rC
+ *   jmp   <label>             jz|jnz rA, <label>
+ *   ldf   rA, <field>         stf   rA, <field>
+ *   call  <native>, rA, <argc>
+ *
+ * Registers are r0..r15. Field and native names are resolved against the
+ * ScriptBindings passed to the compiler, so a typo is a compile error
+ * rather than a runtime lookup failure; so is `stf` to a read-only field.
+ * A HALT is appended after the last line so a script cannot run off the
+ * end of its code.
+ */
+
+/*
+ * script_compile
+ *
+ * Purpose: compile script source text into bytecode.
+ *
+ * `name` is only used in diagnostics. Returns 0 on success, non-zero on
+ * failure (with a diagnostic printed to stderr). On success the caller owns
+ * `prog` and must call script_program_destroy().
+ */
+int script_compile(ScriptProgram *prog, const char *source, const char *name,
+                   const ScriptBindings *bindings);
+
+/*
+ * script_compile_file
+ *
+ * Purpose: read a script from disk and compile it with script_compile().
+ */
+int script_compile_file(ScriptProgram *prog, const char *path,
+                        const ScriptBindings *bindings);
+
+#endif /* ENGINE_SCRIPTING_SCRIPT_COMPILER_H */
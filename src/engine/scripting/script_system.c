@@ -0,0 +1,118 @@
+#include "script_system.h"
+#include "script_compiler.h"
+#include <string.h>
+
+/*
+ * script_system_init
+ *
+ * Start with no scripts. Bindings are copied by value; the tables they point
+ * at are not.
+ */
+void script_system_init(ScriptSystem *sys, const ScriptBindings *bindings, int frame_budget) {
+    memset(sys, 0, sizeof(*sys));
+    sys->bindings = *bindings;
+    sys->frame_budget = frame_budget;
+}
+
+/*
+ * script_system_load
+ *
+ * Compile the script and add it to the next free slot.
+ *
+ * Why: compilation (and all operand validation) happens here at load time
+ * rather than during the frame, so the per-frame cost is bytecode execution
+ * only.
+ */
+int script_system_load(ScriptSystem *sys, const char *name, const char *path) {
+    if (sys->script_count >= SCRIPT_SYSTEM_MAX_SCRIPTS) {
+        fprintf(stderr, "Failed to load script %s: too many scripts\n", name);
+        return -1;
+    }
+
+    Script *script = &sys->scripts[sys->script_count];
+    memset(script, 0, sizeof(*script));
+    if (script_compile_file(&script->program, path, &sys->bindings) != 0) {
+        fprintf(stderr, "Failed to load script: %s\n", path);
+        return -1;
+    }
+
+    strncpy(script->name, name, SCRIPT_NAME_LENGTH - 1);
+    script_context_reset(&script->ctx);
+    sys->script_count++;
+    return 0;
+}
+
+/*
+ * script_system_update
+ *
+ * Run each script once, starting from a rotating index, charging executed
+ * instructions against the frame budget and recording per-script cost.
+ */
+void script_system_update(ScriptSystem *sys) {
+    int remaining = sys->frame_budget;
+
+    for (int n = 0; n < sys->script_count && remaining > 0; n++) {
+        Script *script = &sys->scripts[(sys->next_start + n) % sys->script_count];
+        if (script->disabled) continue;
+
+        int executed = 0;
+        Uint64 start = SDL_GetPerformanceCounter();
+        ScriptStatus status = script_vm_run(&script->ctx, &script->program,
+                                            &sys->bindings, remaining, &executed);
+        Uint64 elapsed = SDL_GetPerformanceCounter() - start;
+
+        remaining -= executed;
+        script->stats.last_instructions = executed;
+        script->stats.last_ticks = elapsed;
+        script->stats.total_instructions += (Uint64)executed;
+        script->stats.total_ticks += elapsed;
+        script->stats.runs++;
+
+        if (status == SCRIPT_STATUS_BUDGET) {
+            script->stats.budget_stalls++;
+        } else if (status == SCRIPT_STATUS_ERROR) {
+            fprintf(stderr, "Script %s disabled after runtime error\n", script->name);
+            script->disabled = 1;
+        }
+    }
+
+    if (sys->script_count > 0) {
+        sys->next_start = (sys->next_start + 1) % sys->script_count;
+    }
+}
+
+/*
+ * script_system_print_profile
+ *
+ * One line per script: total and average cost. Average is per run, so a
+ * script that only does work on some frames is not diluted by frames it was
+ * starved of budget.
+ */
+void script_system_print_profile(const ScriptSystem *sys, FILE *out) {
+    double freq = (double)SDL_GetPerformanceFrequency();
+
+    fprintf(out, "%-*s %10s %14s %12s %10s %8s\n", SCRIPT_NAME_LENGTH - 1,
+            "script", "runs", "instructions", "total ms", "avg us", "stalls");
+    for (int i = 0; i < sys->script_count; i++) {
+        const Script *s = &sys->scripts[i];
+        double total_ms = (double)s->stats.total_ticks * 1000.0 / freq;
+        double avg_us = s->stats.runs ? total_ms * 1000.0 / s->stats.runs : 0.0;
+        fprintf(out, "%-*s %10u %14llu %12.3f %10.3f %8u%s\n", SCRIPT_NAME_LENGTH - 1,
+                s->name, (unsigned)s->stats.runs,
+                (unsigned long long)s->stats.total_instructions,
+                total_ms, avg_us, (unsigned)s->stats.budget_stalls,
+                s->disabled ? " (disabled)" : "");
+    }
+}
+
+/*
+ * script_system_destroy
+ *
+ * Free every compiled program and forget all scripts.
+ */
+void script_system_destroy(ScriptSystem *sys) {
+    for (int i = 0; i < sys->script_count; i++) {
+        script_program_destroy(&sys->scripts[i].program);
+    }
+    sys->script_count = 0;
+}
@@ -0,0 +1,98 @@
+#ifndef ENGINE_SCRIPTING_SCRIPT_SYSTEM_H
+#define ENGINE_SCRIPTING_SCRIPT_SYSTEM_H
+
+#include <SDL2/SDL.h>
+#include <stdio.h>
+#include "script_vm.h"
+
+#define SCRIPT_SYSTEM_MAX_SCRIPTS 32
+#define SCRIPT_NAME_LENGTH        32
+
+/*
+ * ScriptStats
+ *
+ * Per-script profiling counters, updated every frame the script runs.
+ * Ticks are SDL performance-counter ticks (see SDL_GetPerformanceFrequency).
+ */
+typedef struct ScriptStats {
+    int last_instructions;         /* instructions executed in the last frame */
+    Uint64 last_ticks;             /* time spent in the last frame */
+    Uint64 total_instructions;
+    Uint64 total_ticks;
+    Uint32 runs;                   /* frames in which the script ran */
+    Uint32 budget_stalls;          /* frames cut short by the instruction budget */
+} ScriptStats;
+
+/*
+ * Script
+ *
+ * A loaded, compiled script with its own execution context. Scripts whose
+ * context hits a runtime error are disabled until reloaded.
+ */
+typedef struct Script {
+    char name[SCRIPT_NAME_LENGTH];
+    ScriptProgram program;
+    ScriptContext ctx;
+    ScriptStats stats;
+    int disabled;
+} Script;
+
+/*
+ * ScriptSystem
+ *
+ * Owns all loaded scripts and runs them once per frame against a shared
+ * instruction budget. Storage is fixed-size so running scripts never
+ * allocates.
+ */
+typedef struct ScriptSystem {
+    Script scripts[SCRIPT_SYSTEM_MAX_SCRIPTS];
+    int script_count;
+    ScriptBindings bindings;
+    int frame_budget;   /* max instructions across all scripts per frame */
+    int next_start;     /* round-robin start so one script cannot starve the rest */
+} ScriptSystem;
+
+/*
+ * script_system_init
+ *
+ * Purpose: set up an empty script system using `bindings` for every script
+ * it loads. The bindings tables must outlive the system.
+ */
+void script_system_init(ScriptSystem *sys, const ScriptBindings *bindings, int frame_budget);
+
+/*
+ * script_system_load
+ *
+ * Purpose: compile the script at `path` and register it under `name`.
+ *
+ * Returns 0 on success, non-zero on failure (compile error, file missing,
+ * or too many scripts).
+ */
+int script_system_load(ScriptSystem *sys, const char *name, const char *path);
+
+/*
+ * script_system_update
+ *
+ * Purpose: run every enabled script for this frame.
+ *
+ * Each script resumes where it last stopped (after YIELD or a budget stall)
+ * or from the top if it previously HALTed. Once the frame budget is spent
+ * the remaining scripts wait until the next frame.
+ */
+void script_system_update(ScriptSystem *sys);
+
+/*
+ * script_system_print_profile
+ *
+ * Purpose: write a per-script cost table (instructions and time) to `out`.
+ */
+void script_system_print_profile(const ScriptSystem *sys, FILE *out);
+
+/*
+ * script_system_destroy
+ *
+ * Purpose: free all compiled programs.
+ */
+void script_system_destroy(ScriptSystem *sys);
+
+#endif /* ENGINE_SCRIPTING_SCRIPT_SYSTEM_H */
@@ -0,0 +1,147 @@
+#include "script_vm.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/*
+ * script_context_reset
+ *
+ * Zero the registers and rewind to the first instruction.
+ */
+void script_context_reset(ScriptContext *ctx) {
+    memset(ctx->regs, 0, sizeof(ctx->regs));
+    ctx->pc = 0;
+}
+
+/*
+ * script_vm_run
+ *
+ * Fetch/decode/dispatch loop. Registers and pc are copied into locals for
+ * the duration of the run and written back on every exit path.
+ *
+ * Why: the budget check is the only per-instruction overhead besides the
+ * dispatch itself. Operand validity was established by the compiler, so a
+ * runaway script costs at most `budget` instructions per call and then
+ * resumes where it left off on the next call.
+ */
+ScriptStatus script_vm_run(ScriptContext *ctx, const ScriptProgram *prog,
+                           const ScriptBindings *bindings, int budget,
+                           int *executed) {
+    int *r = ctx->regs;
+    const uint32_t *code = prog->code;
+    int pc = ctx->pc;
+    int count = 0;
+    ScriptStatus status = SCRIPT_STATUS_BUDGET;
+
+    while (count < budget) {
+        uint32_t ins = code[pc++];
+        count++;
+
+        switch (SCRIPT_OP(ins)) {
+            case SCRIPT_OP_HALT:
+                pc = 0;
+                status = SCRIPT_STATUS_HALTED;
+                goto done;
+            case SCRIPT_OP_YIELD:
+                status = SCRIPT_STATUS_YIELDED;
+                goto done;
+            case SCRIPT_OP_MOV:
+                r[SCRIPT_A(ins)] = r[SCRIPT_B(ins)];
+                break;
+            case SCRIPT_OP_LOADK:
+                r[SCRIPT_A(ins)] = prog->constants[SCRIPT_BC(ins)];
+                break;
+            /* Arithmetic is done in uint32_t so overflow wraps (two's
+             * complement) instead of being undefined behaviour. */
+            case SCRIPT_OP_ADD:
+                r[SCRIPT_A(ins)] = (int)((uint32_t)r[SCRIPT_B(ins)] + (uint32_t)r[SCRIPT_C(ins)]);
+                break;
+            case SCRIPT_OP_SUB:
+                r[SCRIPT_A(ins)] = (int)((uint32_t)r[SCRIPT_B(ins)] - (uint32_t)r[SCRIPT_C(ins)]);
+                break;
+            case SCRIPT_OP_MUL:
+                r[SCRIPT_A(ins)] = (int)((uint32_t)r[SCRIPT_B(ins)] * (uint32_t)r[SCRIPT_C(ins)]);
+                break;
+            case SCRIPT_OP_DIV:
+            case SCRIPT_OP_MOD: {
+                int divisor = r[SCRIPT_C(ins)];
+                if (divisor == 0) {
+                    fprintf(stderr, "Script error: division by zero at pc %d\n", pc - 1);
+                    pc--;
+                    status = SCRIPT_STATUS_ERROR;
+                    goto done;
+                }
+                if (divisor == -1) {
+                    /* INT_MIN / -1 traps on x86; -1 is always exact, so
+                     * DIV is a wrapped negation and MOD is 0. */
+                    r[SCRIPT_A(ins)] = SCRIPT_OP(ins) == SCRIPT_OP_DIV
+                        ? (int)(0u - (uint32_t)r[SCRIPT_B(ins)])
+                        : 0;
+                } else if (SCRIPT_OP(ins) == SCRIPT_OP_DIV) {
+                    r[SCRIPT_A(ins)] = r[SCRIPT_B(ins)] / divisor;
+                } else {
+                    r[SCRIPT_A(ins)] = r[SCRIPT_B(ins)] % divisor;
+                }
+                break;
+            }
+            case SCRIPT_OP_LT:
+                r[SCRIPT_A(ins)] = r[SCRIPT_B(ins)] < r[SCRIPT_C(ins)];
+                break;
+            case SCRIPT_OP_LE:
+                r[SCRIPT_A(ins)] = r[SCRIPT_B(ins)] <= r[SCRIPT_C(ins)];
+                break;
+            case SCRIPT_OP_EQ:
+                r[SCRIPT_A(ins)] = r[SCRIPT_B(ins)] == r[SCRIPT_C(ins)];
+                break;
+            case SCRIPT_OP_NOT:
+                r[SCRIPT_A(ins)] = !r[SCRIPT_B(ins)];
+                break;
+            case SCRIPT_OP_JMP:
+                pc = SCRIPT_BC(ins);
+                break;
+            case SCRIPT_OP_JZ:
+                if (r[SCRIPT_A(ins)] == 0) pc = SCRIPT_BC(ins);
+                break;
+            case SCRIPT_OP_JNZ:
+                if (r[SCRIPT_A(ins)] != 0) pc = SCRIPT_BC(ins);
+                break;
+            case SCRIPT_OP_LDF:
+                r[SCRIPT_A(ins)] = *bindings->fields[SCRIPT_BC(ins)].ptr;
+                break;
+            case SCRIPT_OP_STF:
+                *bindings->fields[SCRIPT_BC(ins)].ptr = r[SCRIPT_A(ins)];
+                break;
+            case SCRIPT_OP_CALL: {
+                int base = SCRIPT_A(ins);
+                r[base] = bindings->natives[SCRIPT_C(ins)].fn(bindings->user, &r[base], SCRIPT_B(ins));
+                break;
+            }
+            default:
+                /* Unreachable for compiler-produced programs. */
+                fprintf(stderr, "Script error: bad opcode %u at pc %d\n", SCRIPT_OP(ins), pc - 1);
+                pc--;
+                status = SCRIPT_STATUS_ERROR;
+                goto done;
+        }
+    }
+
+done:
+    ctx->pc = pc;
+    if (executed) *executed = count;
+    return status;
+}
+
+/*
+ * script_program_destroy
+ *
+ * Free compiled program storage. Safe to call on a zeroed or already
+ * destroyed program.
+ */
+void script_program_destroy(ScriptProgram *prog) {
+    free(prog->code);
+    free(prog->constants);
+    prog->code = NULL;
+    prog->constants = NULL;
+    prog->code_length = 0;
+    prog->constant_count = 0;
+}
@@ -0,0 +1,175 @@
+#ifndef ENGINE_SCRIPTING_SCRIPT_VM_H
+#define ENGINE_SCRIPTING_SCRIPT_VM_H
+
+#include <stdint.h>
+
+/*
+ * Register-based bytecode VM for game scripts (quests, dialogue, triggers).
+ *
+ * Scripts are compiled once at load time (see script_compiler.h) into a
+ * ScriptProgram. Running a program never allocates: all execution state
+ * lives in a fixed-size ScriptContext owned by the caller.
+ *
+ * Instruction encoding: one 32-bit word per instruction.
+ *
+ *   bits  0..7   opcode
+ *   bits  8..15  A  (destination register / first operand)
+ *   bits 16..23  B
+ *   bits 24..31  C
+ *
+ * Instructions that need a wider operand (constant index, jump target,
+ * field index) use B and C together as a 16-bit value "BC".
+ */
+
+#define SCRIPT_NUM_REGISTERS 16
+#define SCRIPT_MAX_CODE      4096
+#define SCRIPT_MAX_CONSTANTS 256
+
+#define SCRIPT_OP(ins)  ((uint8_t)((ins) & 0xFF))
+#define SCRIPT_A(ins)   ((uint8_t)(((ins) >> 8) & 0xFF))
+#define SCRIPT_B(ins)   ((uint8_t)(((ins) >> 16) & 0xFF))
+#define SCRIPT_C(ins)   ((uint8_t)(((ins) >> 24) & 0xFF))
+#define SCRIPT_BC(ins)  ((uint16_t)(((ins) >> 16) & 0xFFFF))
+
+#define SCRIPT_ENCODE(op, a, b, c) \
+    ((uint32_t)(op) | ((uint32_t)(a) << 8) | ((uint32_t)(b) << 16) | ((uint32_t)(c) << 24))
+#define SCRIPT_ENCODE_BC(op, a, bc) \
+    ((uint32_t)(op) | ((uint32_t)(a) << 8) | ((uint32_t)(bc) << 16))
+
+/*
+ * ScriptOpcode
+ *
+ * r[X] is register X, k[X] is constant X, f[X] is bound field X.
+ * ADD/SUB/MUL wrap on overflow (32-bit two's complement); DIV/MOD truncate
+ * toward zero, and INT_MIN / -1 wraps to INT_MIN (INT_MIN % -1 is 0).
+ */
+typedef enum ScriptOpcode {
+    SCRIPT_OP_HALT = 0,  /* finish; next run starts from the top          */
+    SCRIPT_OP_YIELD,     /* suspend; next run resumes after this op       */
+    SCRIPT_OP_MOV,       /* r[A] = r[B]                                   */
+    SCRIPT_OP_LOADK,     /* r[A] = k[BC]                                  */
+    SCRIPT_OP_ADD,       /* r[A] = r[B] + r[C]  (wraps)                   */
+    SCRIPT_OP_SUB,       /* r[A] = r[B] - r[C]  (wraps)                   */
+    SCRIPT_OP_MUL,       /* r[A] = r[B] * r[C]  (wraps)                   */
+    SCRIPT_OP_DIV,       /* r[A] = r[B] / r[C]  (error if r[C] == 0)      */
+    SCRIPT_OP_MOD,       /* r[A] = r[B] % r[C]  (error if r[C] == 0)      */
+    SCRIPT_OP_LT,        /* r[A] = r[B] <  r[C]                           */
+    SCRIPT_OP_LE,        /* r[A] = r[B] <= r[C]                           */
+    SCRIPT_OP_EQ,        /* r[A] = r[B] == r[C]                           */
+    SCRIPT_OP_NOT,       /* r[A] = !r[B]                                  */
+    SCRIPT_OP_JMP,       /* pc = BC                                       */
+    SCRIPT_OP_JZ,        /* if r[A] == 0: pc = BC                         */
+    SCRIPT_OP_JNZ,       /* if r[A] != 0: pc = BC                         */
+    SCRIPT_OP_LDF,       /* r[A] = *f[BC]                                 */
+    SCRIPT_OP_STF,       /* *f[BC] = r[A]                                 */
+    SCRIPT_OP_CALL,      /* r[A] = native[C](r[A] .. r[A+B-1])            */
+    SCRIPT_OP_COUNT
+} ScriptOpcode;
+
+/*
+ * ScriptNativeFn
+ *
+ * Engine function callable from scripts. `args` points at `argc`
+ * consecutive registers; the return value is written to the first of them.
+ */
+typedef int (*ScriptNativeFn)(void *user, const int *args, int argc);
+
+/*
+ * ScriptField / ScriptNative
+ *
+ * Name -> engine data bindings. Fields point directly at component data so
+ * LDF/STF are a single load/store with no lookup at run time; names are only
+ * used by the compiler to resolve indices. Read-only fields are rejected as
+ * STF targets at compile time.
+ */
+typedef struct ScriptField {
+    const char *name;
+    int *ptr;
+    int read_only;
+} ScriptField;
+
+typedef struct ScriptNative {
+    const char *name;
+    ScriptNativeFn fn;
+} ScriptNative;
+
+/*
+ * ScriptBindings
+ *
+ * The set of fields and natives a program was compiled against. The tables
+ * must outlive every program compiled against them.
+ */
+typedef struct ScriptBindings {
+    const ScriptField *fields;
+    int field_count;
+    const ScriptNative *natives;
+    int native_count;
+    void *user; /* passed to every native */
+} ScriptBindings;
+
+/*
+ * ScriptProgram
+ *
+ * Compiled bytecode plus its constant pool. Produced by script_compile();
+ * operand indices are validated there so the interpreter loop does not need
+ * to bounds-check registers, constants, fields or jump targets. Register
+ * values are not validated; every opcode is defined for all of them.
+ */
+typedef struct ScriptProgram {
+    uint32_t *code;
+    int code_length;
+    int *constants;
+    int constant_count;
+} ScriptProgram;
+
+/*
+ * ScriptStatus
+ *
+ * Result of a single script_vm_run() call.
+ */
+typedef enum ScriptStatus {
+    SCRIPT_STATUS_HALTED = 0, /* ran to HALT                              */
+    SCRIPT_STATUS_YIELDED,    /* hit YIELD, resumes next run              */
+    SCRIPT_STATUS_BUDGET,     /* ran out of instructions, resumes next run */
+    SCRIPT_STATUS_ERROR       /* runtime error (e.g. divide by zero)      */
+} ScriptStatus;
+
+/*
+ * ScriptContext
+ *
+ * Per-script execution state. Fixed size so it can be embedded in other
+ * structs; no heap memory is touched while running.
+ */
+typedef struct ScriptContext {
+    int regs[SCRIPT_NUM_REGISTERS];
+    int pc;
+} ScriptContext;
+
+/*
+ * script_context_reset
+ *
+ * Purpose: clear registers and restart the script from its first instruction.
+ */
+void script_context_reset(ScriptContext *ctx);
+
+/*
+ * script_vm_run
+ *
+ * Purpose: execute `prog` from ctx->pc for at most `budget` instructions.
+ *
+ * Returns the reason execution stopped. The number of instructions actually
+ * executed is stored in `*executed` (if non-NULL) so callers can charge it
+ * against a frame budget and report it in profiling.
+ */
+ScriptStatus script_vm_run(ScriptContext *ctx, const ScriptProgram *prog,
+                           const ScriptBindings *bindings, int budget,
+                           int *executed);
+
+/*
+ * script_program_destroy
+ *
+ * Purpose: free the bytecode and constant pool of a compiled program.
+ */
+void script_program_destroy(ScriptProgram *prog);
+
+#endif /* ENGINE_SCRIPTING_SCRIPT_VM_H */
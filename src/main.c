@@ -1,6 +1,7 @@
 #include "engine/graphics/window.h"
 #include "engine/renderer/render_system.h"
 #include "engine/input/input.h"
+#include <stdlib.h>
 
 /*
  * main
@@ -54,6 +55,11 @@ int main(void) {
         SDL_Delay(16);
     }
 
+    /* Opt-in per-script cost report, e.g. DRPG_PROFILE=1 ./rpg_game */
+    if (getenv("DRPG_PROFILE")) {
+        render_system_print_profile(&render_state, stderr);
+    }
+
     /* Clean up resources */
     render_system_destroy(&render_state);
     window_destroy(&win);